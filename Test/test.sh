@@ -13,10 +13,15 @@ cd ..
 cd Test
 ../vcf-split test-all-fields- 1 11 < test.vcf
 ../vcf-split --fields chrom,pos,ref,alt,format test-limited-fields- 1 11 < test.vcf
+../vcf-split --format-keys GT,AD test-format-keys- 1 3 < format-keys.vcf
+../vcf-split --het-only --format-keys GT,AD test-het-format-keys- 1 3 \
+    < format-keys.vcf
+../vcf-split --alt-only --format-keys GT test-alt-format-keys- 1 3 \
+    < format-keys.vcf
 rm -f *.done
 
 printf "All files should be 12 lines:\n"
-wc -l test-*.vcf
+wc -l test-*-fields-*.vcf
 pause
 
 printf "There should be no differences shown below:\n"
@@ -24,4 +29,9 @@ for col in $(seq 11); do
     diff test-all-fields-$col.vcf correct-all-fields-$col.vcf
     diff test-limited-fields-$col.vcf correct-limited-fields-$col.vcf
 done
+for col in $(seq 3); do
+    diff test-format-keys-$col.vcf correct-format-keys-$col.vcf
+    diff test-het-format-keys-$col.vcf correct-het-format-keys-$col.vcf
+    diff test-alt-format-keys-$col.vcf correct-alt-format-keys-$col.vcf
+done
 rm -f test-*.vcf
@@ -45,6 +45,7 @@ int     main(int argc, char *argv[])
     const char  *outfile_prefix,
 		*selected_samples_file = NULL;
     id_list_t   *selected_sample_ids = NULL;
+    format_keys_t   *format_keys = NULL;
     size_t      first_col,
 		last_col,
 		max_calls = SIZE_MAX;
@@ -118,6 +119,13 @@ int     main(int argc, char *argv[])
 		usage(argv);
 	}
 	
+	else if ( strcmp(argv[next_arg], "--format-keys") == 0 )
+	{
+	    if ( ++next_arg == argc )
+		usage(argv);
+	    format_keys = parse_format_keys(argv, argv[next_arg++]);
+	}
+	
 	else
 	    usage(argv);
     }
@@ -149,8 +157,14 @@ int     main(int argc, char *argv[])
 	usage(argv);
     }
     
+    // Projection and GT lookup need the real FORMAT, even if --fields
+    // omitted it
+    if ( (format_keys != NULL) || (flags != FLAG_NONE) )
+	field_mask |= BL_VCF_FIELD_FORMAT;
+    
     return vcf_split(argv, stdin, outfile_prefix, first_col, last_col,
-		     selected_sample_ids, max_calls, flags, field_mask);
+		     selected_sample_ids, max_calls, flags, field_mask,
+		     format_keys);
 }
 
 
@@ -167,7 +181,8 @@ int     vcf_split(char *argv[], FILE *vcf_infile,
 		  const char *outfile_prefix,
 		  size_t first_col, size_t last_col,
 		  id_list_t *selected_sample_ids, size_t max_calls,
-		  flag_t flags, vcf_field_mask_t field_mask)
+		  flag_t flags, vcf_field_mask_t field_mask,
+		  format_keys_t *format_keys)
 
 {
     char    inbuf[BUFF_SIZE + 1],
@@ -204,7 +219,8 @@ int     vcf_split(char *argv[], FILE *vcf_infile,
     write_output_files(argv, vcf_infile, meta_stream, 
 		       (const char **)all_sample_ids,
 		       selected, outfile_prefix,
-		       first_col, last_col, max_calls, flags, field_mask);
+		       first_col, last_col, max_calls, flags, field_mask,
+		       format_keys);
     
     return EX_OK;
 }
@@ -226,7 +242,8 @@ void    write_output_files(char *argv[], FILE *vcf_infile, FILE *header,
 			    const char *outfile_prefix,
 			    size_t first_col, size_t last_col,
 			    size_t max_calls, flag_t flags,
-			    vcf_field_mask_t field_mask)
+			    vcf_field_mask_t field_mask,
+			    format_keys_t *format_keys)
 
 {
     size_t  columns = last_col - first_col + 1,
@@ -280,7 +297,7 @@ void    write_output_files(char *argv[], FILE *vcf_infile, FILE *header,
     // Heart of the program, split each VCF line across multiple files
     for (c = 0; xt_split_line(argv, vcf_infile, vcf_outfiles, all_sample_ids,
 			   selected, first_col, last_col, max_calls, flags,
-			   field_mask);
+			   field_mask, format_keys);
 			   ++c)
 	;
     
@@ -325,15 +342,18 @@ void    write_output_files(char *argv[], FILE *vcf_infile, FILE *header,
 int     xt_split_line(char *argv[], FILE *vcf_infile, FILE *vcf_outfiles[],
 		   const char *all_sample_ids[], bool selected[],
 		   size_t first_col, size_t last_col, size_t max_calls,
-		   flag_t flags, vcf_field_mask_t field_mask)
+		   flag_t flags, vcf_field_mask_t field_mask,
+		   format_keys_t *format_keys)
 
 {
     static size_t   line_count = 0,
 		    max_info_len = 0;
     size_t          c, field_len, col_index;
-    int             delimiter = ' ';        // Silence false uninit warning
+    int             delimiter = ' ',        // Silence false uninit warning
+		    gt_position = 0;
     static bl_vcf_t vcf_call;
     char            *genotype;
+    const char      *gt;
     static size_t   genotype_array_size = 0;    // Reuse allocated buffer
     
     /*
@@ -357,7 +377,17 @@ int     xt_split_line(char *argv[], FILE *vcf_infile, FILE *vcf_outfiles[],
 	
 	if ( BL_VCF_INFO_LEN(&vcf_call) > max_info_len )
 	    max_info_len = BL_VCF_INFO_LEN(&vcf_call);
-	
+
+	/*
+	 *  Locate GT from FORMAT rather than assuming it comes first, and
+	 *  do it before --format-keys rewrites FORMAT for the output.
+	 *  -1 if this call has no GT.
+	 */
+	if ( flags != FLAG_NONE )
+	    gt_position = format_key_position(BL_VCF_FORMAT(&vcf_call), "GT");
+	if ( format_keys != NULL )
+	    map_format_keys(argv, format_keys, BL_VCF_FORMAT(&vcf_call));
+
 	// Skip columns before first_col
 	for (c = 1; c < first_col; ++c)
 	{
@@ -386,15 +416,25 @@ int     xt_split_line(char *argv[], FILE *vcf_infile, FILE *vcf_outfiles[],
 	    col_index = c - first_col;
 	    if ( selected[col_index] )
 	    {
+		gt = gt_position < 0 ? NULL :
+		     sample_subfield(genotype, gt_position);
+		// Need at least "a/b" to compare alleles, not "." or "0"
+		if ( (gt != NULL) && (strcspn(gt, ":") < 3) )
+		    gt = NULL;
 		// FIXME: Should this be flags & FLAG_*
 		if ( (flags == FLAG_NONE) ||
-		     ((flags == FLAG_HET) && (genotype[0] != genotype[2])) ||
-		     ((flags == FLAG_ALT) &&
-		      ((genotype[0] == '1') || (genotype[2] == '1'))) )
+		     ((flags == FLAG_HET) && (gt != NULL) && (gt[0] != gt[2])) ||
+		     ((flags == FLAG_ALT) && (gt != NULL) &&
+		      ((gt[0] == '1') || (gt[2] == '1'))) )
 		{
 		    bl_vcf_write_static_fields(&vcf_call,
 			vcf_outfiles[col_index], BL_VCF_FIELD_ALL);
-		    fprintf(vcf_outfiles[col_index], "%s\n", genotype);
+		    if ( format_keys == NULL )
+			fputs(genotype, vcf_outfiles[col_index]);
+		    else
+			write_sample_subfields(vcf_outfiles[col_index],
+					       genotype, format_keys);
+		    putc('\n', vcf_outfiles[col_index]);
 		    /*
 		    fprintf(vcf_outfiles[col_index],
 			    "%s\t%s\t%s\t%s\t%s\t.\t.\t.\t%s\t%s\n",
@@ -555,13 +595,231 @@ size_t  read_string(FILE *fp, char *buff, size_t maxlen)
 }
 
 
+/***************************************************************************
+ *  Description:
+ *      Parse the comma-separated key list given to --format-keys.
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-18  agent       Begin
+ ***************************************************************************/
+
+format_keys_t   *parse_format_keys(char *argv[], const char *key_list)
+
+{
+    format_keys_t   *format_keys;
+    char            *keys_copy, *key;
+    size_t          c;
+
+    if ( (format_keys = (format_keys_t *)malloc(sizeof(format_keys_t)))
+	    == NULL )
+    {
+	fprintf(stderr, "%s: Cannot allocate format_keys structure.\n", argv[0]);
+	exit(EX_UNAVAILABLE);
+    }
+
+    // Keys point into keys_copy, which is never freed
+    if ( (keys_copy = strdup(key_list)) == NULL )
+    {
+	fprintf(stderr, "%s: Cannot allocate format key list.\n", argv[0]);
+	exit(EX_UNAVAILABLE);
+    }
+
+    // Commas + 1 is an upper bound on the number of keys
+    for (c = 1, key = keys_copy; *key != '\0'; ++key)
+	if ( *key == ',' )
+	    ++c;
+    if ( ((format_keys->keys = (char **)malloc(c * sizeof(char *))) == NULL) ||
+	 ((format_keys->key_lens = (size_t *)malloc(c * sizeof(size_t)))
+	    == NULL) )
+    {
+	fprintf(stderr, "%s: Cannot allocate format key list.\n", argv[0]);
+	exit(EX_UNAVAILABLE);
+    }
+
+    // Lengths are compared against every FORMAT sub-field on every line
+    format_keys->count = 0;
+    for (key = strtok(keys_copy, ","); key != NULL; key = strtok(NULL, ","))
+    {
+	format_keys->key_lens[format_keys->count] = strlen(key);
+	format_keys->keys[format_keys->count++] = key;
+    }
+
+    if ( format_keys->count == 0 )
+    {
+	fprintf(stderr, "%s: --format-keys requires at least one key.\n",
+		argv[0]);
+	usage(argv);
+    }
+    format_keys->last_wanted = -1;
+    return format_keys;
+}
+
+
+/***************************************************************************
+ *  Description:
+ *      Find the position of key within a colon-separated FORMAT string.
+ *
+ *  Returns:
+ *      0-based position of key, or -1 if not present.
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-18  agent       Begin
+ ***************************************************************************/
+
+int     format_key_position(const char *format, const char *key)
+
+{
+    size_t  key_len = strlen(key),
+	    len;
+    int     position;
+
+    for (position = 0; ; ++position)
+    {
+	len = strcspn(format, ":");
+	if ( (len == key_len) && (memcmp(format, key, len) == 0) )
+	    return position;
+	if ( format[len] != ':' )
+	    return -1;
+	format += len + 1;
+    }
+}
+
+
+/***************************************************************************
+ *  Description:
+ *      Map the keys selected by --format-keys to their positions in
+ *      the current FORMAT, and rewrite FORMAT in place to contain only
+ *      those keys, in their original order.  Called once per line, so
+ *      sample columns need not be matched against key names.
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-18  agent       Begin
+ ***************************************************************************/
+
+void    map_format_keys(char *argv[], format_keys_t *format_keys,
+			char *format)
+
+{
+    char    *p = format,
+	    *w = format;
+    size_t  len, k;
+    int     position;
+    bool    wanted;
+
+    format_keys->last_wanted = -1;
+    for (position = 0; ; ++position)
+    {
+	if ( position == VCF_FORMAT_SUBFIELDS_MAX )
+	{
+	    fprintf(stderr, "%s: More than %d FORMAT sub-fields.\n"
+		    "Increase VCF_FORMAT_SUBFIELDS_MAX and recompile.\n",
+		    argv[0], VCF_FORMAT_SUBFIELDS_MAX);
+	    exit(EX_DATAERR);
+	}
+
+	len = strcspn(p, ":");
+	for (k = 0, wanted = false; !wanted && (k < format_keys->count); ++k)
+	    wanted = (format_keys->key_lens[k] == len) &&
+		     (memcmp(format_keys->keys[k], p, len) == 0);
+	format_keys->wanted[position] = wanted;
+
+	if ( wanted )
+	{
+	    if ( w != format )
+		*w++ = ':';
+	    memmove(w, p, len);
+	    w += len;
+	    format_keys->last_wanted = position;
+	}
+
+	if ( p[len] != ':' )
+	    break;
+	p += len + 1;
+    }
+
+    // None of the requested keys are present
+    if ( w == format )
+	*w++ = '.';
+    *w = '\0';
+}
+
+
+/***************************************************************************
+ *  Description:
+ *      Find a sub-field in a colon-separated sample column.
+ *
+ *  Returns:
+ *      Pointer to the start of the sub-field, or NULL if the sample
+ *      has fewer sub-fields (trailing sub-fields may be dropped).
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-18  agent       Begin
+ ***************************************************************************/
+
+const char  *sample_subfield(const char *sample, int position)
+
+{
+    for (; position > 0; --position)
+    {
+	if ( (sample = strchr(sample, ':')) == NULL )
+	    return NULL;
+	++sample;
+    }
+    return sample;
+}
+
+
+/***************************************************************************
+ *  Description:
+ *      Write only the sub-fields of a sample column selected by
+ *      map_format_keys().  The sample is scanned only as far as the
+ *      last wanted sub-field.
+ *
+ *  History:
+ *  Date        Name        Modification
+ *  2026-10-18  agent       Begin
+ ***************************************************************************/
+
+void    write_sample_subfields(FILE *stream, const char *sample,
+			       format_keys_t *format_keys)
+
+{
+    size_t  len;
+    int     position;
+    bool    written = false;
+
+    for (position = 0; position <= format_keys->last_wanted; ++position)
+    {
+	len = strcspn(sample, ":");
+	if ( format_keys->wanted[position] )
+	{
+	    if ( written )
+		putc(':', stream);
+	    fwrite(sample, len, 1, stream);
+	    written = true;
+	}
+	if ( sample[len] != ':' )
+	    break;
+	sample += len + 1;
+    }
+
+    if ( ! written )
+	putc('.', stream);
+}
+
+
 void    usage(char *argv[])
 
 {
     fprintf(stderr, "\nUsage: %s\n\t[--version]\n", argv[0]);
     fprintf(stderr, "\nUsage: %s\n\t[--het-only]\n\t[--alt-only]\n\t"
 		    "[--max-calls N]\n\t[--sample-id-file file]\n\t"
-		    "[--fields field-spec]\n\toutput-file-prefix\n\t"
+		    "[--fields field-spec]\n\t[--format-keys key-list]\n\t"
+		    "output-file-prefix\n\t"
 		    "first-column\n\tlast-column\n\n", argv[0]);
     fputs("Press return to continue...", stderr);
     getchar();
@@ -576,6 +834,9 @@ void    usage(char *argv[])
 		    "including one or more of\n\n"
 		    "chrom,pos,id,ref,alt,qual,filter,info\n\n"
 		    "fields not indicated are replaced with a '.'.\n\n"
+		    "key-list is a comma-separated list of FORMAT keys to include in\n"
+		    "the output, such as GT,AD.  Other sub-fields are removed from\n"
+		    "FORMAT and the sample column.\n\n"
 		    "output-file-prefix is prepended to .vcf\n"
 		    "It may include one or more subdirectories\n\n"
 		    "first-column and last column indicate the range of samples to process\n"
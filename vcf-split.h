@@ -19,6 +19,20 @@ typedef struct
     char    **ids;
 }   id_list_t;
 
+// Upper limit on sub-fields in a FORMAT column handled by --format-keys
+#define VCF_FORMAT_SUBFIELDS_MAX    256
+
+// FORMAT sub-fields selected by --format-keys
+typedef struct
+{
+    size_t  count;
+    char    **keys;
+    size_t  *key_lens;
+    // Map of requested keys to positions in the current FORMAT
+    bool    wanted[VCF_FORMAT_SUBFIELDS_MAX];
+    int     last_wanted;    // No need to scan sample columns past this
+}   format_keys_t;
+
 typedef unsigned char   flag_t;
 
 #define FLAG_NONE   0x0